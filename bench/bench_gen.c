@@ -0,0 +1,140 @@
+#include "../src/utils.h"
+
+#define DEFAULT_SCALE 10000
+#define LETS_PER_PROC 100
+#define STRING_LEN 256
+#define COMMENT_LINES 8
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+// NOTE(nic): every workload writes a complete program to stdout, `scale` is the
+//            number of procs, the depth of the chain, the calls or the lets
+typedef enum {
+    WORKLOAD_PROCS,
+    WORKLOAD_DEEP,
+    WORKLOAD_WIDE,
+    WORKLOAD_LETS,
+    WORKLOAD_STRINGS,
+    WORKLOAD_COMMENTS,
+    WORKLOAD_COUNT,
+} Workload;
+
+static const char *workload_names[WORKLOAD_COUNT] = {
+    [WORKLOAD_PROCS]    = "procs",
+    [WORKLOAD_DEEP]     = "deep",
+    [WORKLOAD_WIDE]     = "wide",
+    [WORKLOAD_LETS]     = "lets",
+    [WORKLOAD_STRINGS]  = "strings",
+    [WORKLOAD_COMMENTS] = "comments",
+};
+
+static const char *workload_help[WORKLOAD_COUNT] = {
+    [WORKLOAD_PROCS]    = "N small procs, main calls each of them once",
+    [WORKLOAD_DEEP]     = "a chain of N procs, each calls the next before printing",
+    [WORKLOAD_WIDE]     = "main calls the same leaf proc N times",
+    [WORKLOAD_LETS]     = "N lets in procs of " STR(LETS_PER_PROC) ", copying each other",
+    [WORKLOAD_STRINGS]  = "N prints of " STR(STRING_LEN) " byte string literals",
+    [WORKLOAD_COMMENTS] = "N procs buried in " STR(COMMENT_LINES) " comment lines each",
+};
+
+static void gen_procs(size_t scale) {
+    for (size_t i = 0; i < scale; ++i) {
+        printf("proc p%zu() {\n    let a = %zu;\n    print(a);\n    print(\"p%zu\");\n}\n\n", i, i, i);
+    }
+    printf("proc main() {\n");
+    for (size_t i = 0; i < scale; ++i) printf("    p%zu();\n", i);
+    printf("}\n");
+}
+
+static void gen_deep(size_t scale) {
+    printf("proc main() {\n    p0();\n}\n\n");
+    for (size_t i = 0; i < scale; ++i) {
+        printf("proc p%zu() {\n", i);
+        if (i + 1 < scale) printf("    p%zu();\n", i + 1);
+        printf("    print(%zu);\n}\n\n", i);
+    }
+}
+
+static void gen_wide(size_t scale) {
+    printf("proc leaf() {\n    let a = 7;\n    print(a);\n}\n\n");
+    printf("proc main() {\n");
+    for (size_t i = 0; i < scale; ++i) printf("    leaf();\n");
+    printf("}\n");
+}
+
+static void gen_lets(size_t scale) {
+    size_t proc_count = (scale + LETS_PER_PROC - 1) / LETS_PER_PROC;
+    for (size_t p = 0; p < proc_count; ++p) {
+        printf("proc p%zu() {\n    let v0 = %zu;\n", p, p);
+        for (size_t i = 1; i < LETS_PER_PROC; ++i) {
+            printf("    let v%zu = v%zu;\n", i, i - 1);
+        }
+        printf("    print(v%d);\n}\n\n", LETS_PER_PROC - 1);
+    }
+    printf("proc main() {\n");
+    for (size_t p = 0; p < proc_count; ++p) printf("    p%zu();\n", p);
+    printf("}\n");
+}
+
+static void gen_strings(size_t scale) {
+    char text[STRING_LEN + 1];
+    printf("proc main() {\n");
+    for (size_t i = 0; i < scale; ++i) {
+        for (size_t j = 0; j < STRING_LEN; ++j) text[j] = (char) ('a' + (i + j) % 26);
+        text[STRING_LEN] = '\0';
+        printf("    print(\"%s\");\n", text);
+    }
+    printf("}\n");
+}
+
+static void gen_comments(size_t scale) {
+    for (size_t i = 0; i < scale; ++i) {
+        for (size_t j = 0; j < COMMENT_LINES; ++j) {
+            printf("// proc p%zu, note %zu: nothing in here is code, the lexer just skips it\n", i, j);
+        }
+        printf("proc p%zu() {\n    // the only statement\n    print(%zu);\n}\n\n", i, i);
+    }
+    printf("proc main() {\n");
+    for (size_t i = 0; i < scale; ++i) printf("    p%zu();\n", i);
+    printf("}\n");
+}
+
+static void print_usage(FILE *stream, const char *program) {
+    fprintf(stream, "Usage: %s <workload> [scale] > program.ç\n", program);
+    fprintf(stream, "Workloads (scale defaults to %d):\n", DEFAULT_SCALE);
+    for (Workload w = 0; w < WORKLOAD_COUNT; ++w) {
+        fprintf(stream, "    %-9s %s\n", workload_names[w], workload_help[w]);
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        print_usage(stderr, argv[0]);
+        exit(1);
+    }
+
+    Workload workload = WORKLOAD_COUNT;
+    for (Workload w = 0; w < WORKLOAD_COUNT; ++w) {
+        if (strcmp(argv[1], workload_names[w]) == 0) workload = w;
+    }
+    if (workload == WORKLOAD_COUNT) {
+        fprintf(stderr, "Error: unknown workload %s\n", argv[1]);
+        print_usage(stderr, argv[0]);
+        exit(1);
+    }
+
+    size_t scale = argc > 2 ? strtoull(argv[2], NULL, 10) : DEFAULT_SCALE;
+    if (scale == 0) scale = 1;
+
+    switch (workload) {
+    case WORKLOAD_PROCS:    gen_procs(scale); break;
+    case WORKLOAD_DEEP:     gen_deep(scale); break;
+    case WORKLOAD_WIDE:     gen_wide(scale); break;
+    case WORKLOAD_LETS:     gen_lets(scale); break;
+    case WORKLOAD_STRINGS:  gen_strings(scale); break;
+    case WORKLOAD_COMMENTS: gen_comments(scale); break;
+    default: assert(0 && "unreachable");
+    }
+    return 0;
+}
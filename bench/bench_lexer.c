@@ -0,0 +1,71 @@
+#define _DEFAULT_SOURCE
+#include "../src/utils.h"
+#include "../src/cdilla_lexer.h"
+#include "../src/cdilla_scan.h"
+
+#include <time.h>
+
+#define DEFAULT_ITERATIONS 10
+
+static f64 now_secs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (f64) ts.tv_sec + (f64) ts.tv_nsec * 1e-9;
+}
+
+static size_t lex_all(String_View content, const char *filepath) {
+    Cdilla_Lexer lexer = cdilla_lexer_new(content, filepath);
+    Cdilla_Tokens tokens = {0};
+    cdilla_lexer_tokenize(&lexer, &tokens);
+    size_t token_count = tokens.count;
+    cdilla_tokens_free(&tokens);
+    return token_count;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <filepath> [iterations]\n", argv[0]);
+        exit(1);
+    }
+    const char *filepath = argv[1];
+    size_t iterations = argc > 2 ? strtoull(argv[2], NULL, 10) : DEFAULT_ITERATIONS;
+    if (iterations == 0) iterations = 1;
+
+    Mapped_File source = {0};
+    Errno err = map_file(filepath, &source);
+    if (err) {
+        fprintf(stderr, "Error: couldn't read file %s: %s\n", filepath, strerror(err));
+        exit(1);
+    }
+
+    // NOTE(nic): warms up the page cache and the symbol table, so every
+    //            implementation measures the same steady state
+    lex_all(source.content, filepath);
+
+    printf("file: %s, %zu bytes, %zu iterations\n", filepath, source.content.count, iterations);
+    for (Cdilla_Scan_Impl impl = 0; impl < CDILLA_SCAN_COUNT; ++impl) {
+        if (!cdilla_scan_select(impl)) {
+            printf("%-8s unsupported on this cpu\n", cdilla_scan_impl_cstr(impl));
+            continue;
+        }
+
+        size_t token_count = 0;
+        f64 begin = now_secs();
+        for (size_t i = 0; i < iterations; ++i) {
+            token_count = lex_all(source.content, filepath);
+        }
+        f64 elapsed = now_secs() - begin;
+
+        f64 bytes = (f64) source.content.count * (f64) iterations;
+        printf(
+            "%-8s %8.3f GB/s %10.2f Mtokens/s (%zu tokens per pass)\n",
+            cdilla_scan_impl_cstr(impl),
+            bytes / elapsed / 1e9,
+            (f64) token_count * (f64) iterations / elapsed / 1e6,
+            token_count);
+    }
+
+    unmap_file(&source);
+    symbols_free();
+    return 0;
+}
@@ -0,0 +1,70 @@
+#define _DEFAULT_SOURCE
+#include "../src/utils.h"
+#include "../src/cdilla_output.h"
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_PRINTS 10000000
+
+static f64 now_secs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (f64) ts.tv_sec + (f64) ts.tv_nsec * 1e-9;
+}
+
+// NOTE(nic): the values look like what scripts print, mostly small with some big ones
+static i64 value_at(size_t i) {
+    return (i % 16 == 0) ? (i64) (i * 2654435761u) : (i64) (i % 1000);
+}
+
+static void report(const char *name, size_t prints, f64 elapsed) {
+    fprintf(stderr, "%-16s %8.3f s %10.2f Mprints/s\n", name, elapsed, (f64) prints / elapsed / 1e6);
+}
+
+int main(int argc, char **argv) {
+    const char *output_path = argc > 1 ? argv[1] : "/dev/null";
+    size_t prints = argc > 2 ? strtoull(argv[2], NULL, 10) : DEFAULT_PRINTS;
+    if (prints == 0) prints = 1;
+
+    int fd = open(output_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "Error: couldn't open %s: %s\n", output_path, strerror(errno));
+        exit(1);
+    }
+
+    // NOTE(nic): stdout is pointed at the output so printf pays for the same kind of file
+    fflush(stdout);
+    if (dup2(fd, STDOUT_FILENO) < 0) {
+        fprintf(stderr, "Error: couldn't redirect stdout: %s\n", strerror(errno));
+        exit(1);
+    }
+
+    fprintf(stderr, "output: %s, %zu prints\n", output_path, prints);
+
+    f64 begin = now_secs();
+    for (size_t i = 0; i < prints; ++i) {
+        printf("%ld\n", value_at(i));
+    }
+    fflush(stdout);
+    report("printf", prints, now_secs() - begin);
+
+    Cdilla_Output_Buffering modes[] = { CDILLA_OUTPUT_FULL, CDILLA_OUTPUT_LINE };
+    const char *names[] = { "cdilla full", "cdilla line" };
+    for (size_t m = 0; m < array_len(modes); ++m) {
+        // NOTE(nic): line buffering is one syscall per print, so it gets fewer of them
+        size_t count = modes[m] == CDILLA_OUTPUT_LINE ? prints / 10 : prints;
+        cdilla_output_init(fd, modes[m]);
+
+        begin = now_secs();
+        for (size_t i = 0; i < count; ++i) {
+            cdilla_output_i64(value_at(i));
+        }
+        cdilla_output_flush();
+        report(names[m], count, now_secs() - begin);
+    }
+
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,166 @@
+#define _DEFAULT_SOURCE
+#include "../src/utils.h"
+#include "../src/cdilla_lexer.h"
+#include "../src/cdilla_parser.h"
+#include "../src/cdilla_resolver.h"
+#include "../src/cdilla_interpreter.h"
+#include "../src/cdilla_output.h"
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#define DEFAULT_ITERATIONS 5
+
+typedef enum {
+    PHASE_READ_FILE,
+    PHASE_LEX,
+    PHASE_PARSE,
+    PHASE_RESOLVE,
+    PHASE_INTERPRET,
+    PHASE_COUNT,
+} Phase;
+
+static const char *phase_names[PHASE_COUNT] = {
+    [PHASE_READ_FILE] = "read_file",
+    [PHASE_LEX]       = "lex",
+    [PHASE_PARSE]     = "parse",
+    [PHASE_RESOLVE]   = "resolve",
+    [PHASE_INTERPRET] = "interpret",
+};
+
+static f64 now_secs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (f64) ts.tv_sec + (f64) ts.tv_nsec * 1e-9;
+}
+
+static size_t lex_all(String_View content, const char *filepath) {
+    Cdilla_Lexer lexer = cdilla_lexer_new(content, filepath);
+    Cdilla_Tokens tokens = {0};
+    cdilla_lexer_tokenize(&lexer, &tokens);
+    size_t token_count = tokens.count;
+    cdilla_tokens_free(&tokens);
+    return token_count;
+}
+
+// NOTE(nic): keeps the best time of every phase, the least disturbed run is the
+//            one that says the most about the code itself
+static void record(f64 *best, Phase phase, f64 begin) {
+    f64 elapsed = now_secs() - begin;
+    if (best[phase] == 0 || elapsed < best[phase]) best[phase] = elapsed;
+}
+
+static void print_json_string(const char *cstr) {
+    putchar('"');
+    for (const char *c = cstr; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') putchar('\\');
+        if ((unsigned char) *c < 0x20) {
+            printf("\\u%04x", *c);
+            continue;
+        }
+        putchar(*c);
+    }
+    putchar('"');
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <filepath> [iterations]\n", argv[0]);
+        fprintf(stderr, "    times every phase on <filepath> and prints the results as json\n");
+        exit(1);
+    }
+    const char *filepath = argv[1];
+    size_t iterations = argc > 2 ? strtoull(argv[2], NULL, 10) : DEFAULT_ITERATIONS;
+    if (iterations == 0) iterations = 1;
+
+    // NOTE(nic): the program output isn't what's measured, only what it costs to produce it
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd < 0) {
+        fprintf(stderr, "Error: couldn't open /dev/null: %s\n", strerror(errno));
+        exit(1);
+    }
+    cdilla_output_init(null_fd, CDILLA_OUTPUT_FULL);
+
+    f64 best[PHASE_COUNT] = {0};
+    String_Builder source = {0};
+    size_t token_count = 0;
+    size_t stmt_count = 0;
+
+    for (size_t i = 0; i < iterations; ++i) {
+        da_count(&source) = 0;
+        f64 begin = now_secs();
+        Errno err = read_file(filepath, &source);
+        record(best, PHASE_READ_FILE, begin);
+        if (err) {
+            fprintf(stderr, "Error: couldn't read file %s: %s\n", filepath, strerror(err));
+            exit(1);
+        }
+    }
+    String_View content = sv_from_sb(&source);
+    cdilla_lexer_check_utf8(content, filepath);
+
+    for (size_t i = 0; i < iterations; ++i) {
+        f64 begin = now_secs();
+        token_count = lex_all(content, filepath);
+        record(best, PHASE_LEX, begin);
+    }
+
+    Cdilla_Ast ast = {0};
+    for (size_t i = 0; i < iterations; ++i) {
+        if (i > 0) cdilla_ast_free(&ast);
+
+        f64 begin = now_secs();
+        Cdilla_Lexer lexer = cdilla_lexer_new(content, filepath);
+        ast = cdilla_parse(&lexer);
+        record(best, PHASE_PARSE, begin);
+
+        begin = now_secs();
+        cdilla_resolve(&ast);
+        record(best, PHASE_RESOLVE, begin);
+    }
+    stmt_count = da_count(&ast.stmts);
+
+    Cdilla_Stack stack = cdilla_stack_new(0);
+    for (size_t i = 0; i < iterations; ++i) {
+        f64 begin = now_secs();
+        cdilla_interpret(&ast, &stack, 0);
+        cdilla_output_flush();
+        record(best, PHASE_INTERPRET, begin);
+    }
+    cdilla_stack_free(&stack);
+
+    struct rusage usage = {0};
+    getrusage(RUSAGE_SELF, &usage);
+
+    f64 mb = (f64) content.count / (1024.0 * 1024.0);
+    printf("{\n");
+    printf("  \"file\": ");
+    print_json_string(filepath);
+    printf(",\n");
+    printf("  \"bytes\": %zu,\n", content.count);
+    printf("  \"tokens\": %zu,\n", token_count);
+    printf("  \"stmts\": %zu,\n", stmt_count);
+    printf("  \"iterations\": %zu,\n", iterations);
+    printf("  \"peak_rss_kb\": %ld,\n", usage.ru_maxrss);
+    printf("  \"phases\": {\n");
+    for (Phase phase = 0; phase < PHASE_COUNT; ++phase) {
+        f64 secs = best[phase];
+        printf("    \"%s\": { \"secs\": %.9f", phase_names[phase], secs);
+        // NOTE(nic): how much runs depends on the calls, not on the size of the file,
+        //            so the interpreter only gets its time
+        if (phase <= PHASE_PARSE) printf(", \"mb_per_sec\": %.3f", mb / secs);
+        if (phase == PHASE_LEX) printf(", \"tokens_per_sec\": %.0f", (f64) token_count / secs);
+        if (phase == PHASE_PARSE || phase == PHASE_RESOLVE) printf(", \"stmts_per_sec\": %.0f", (f64) stmt_count / secs);
+        printf(" }%s\n", phase + 1 < PHASE_COUNT ? "," : "");
+    }
+    printf("  }\n");
+    printf("}\n");
+
+    cdilla_ast_free(&ast);
+    da_free(&source);
+    symbols_free();
+    close(null_fd);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#!/bin/sh
+# Generates every workload and prints one json object per workload on its own line,
+# run ./build.sh bench first. Usage: ./bench/run.sh [scale] [iterations]
+set -e
+
+SCALE=${1:-100000}
+ITERATIONS=${2:-5}
+WORKLOADS="procs deep wide lets strings comments"
+
+mkdir -p ./build/bench/
+
+for workload in $WORKLOADS; do
+    program="./build/bench/$workload.ç"
+    ./build/bench_gen "$workload" "$SCALE" > "$program"
+    printf '{"workload": "%s", "scale": %s, "result": ' "$workload" "$SCALE"
+    ./build/bench_phases "$program" "$ITERATIONS" | tr -d '\n'
+    printf '}\n'
+done
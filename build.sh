@@ -1,13 +1,34 @@
 #!/bin/sh
 set -e
 
-CFLAGS="-Wall -Wextra -pedantic -ggdb -std=c11"
+CFLAGS="-Wall -Wextra -pedantic -ggdb -std=c11 -pthread"
 
 if [ ! -d ./build/ ]; then
     mkdir -p ./build/
 fi;
 
-gcc $CFLAGS -o ./build/cdilla ./src/main.c ./src/utils.c ./src/cdilla_lexer.c ./src/cdilla_parser.c ./src/cdilla_interpreter.c
+SOURCES="./src/utils.c ./src/cdilla_scan.c ./src/cdilla_lexer.c ./src/cdilla_parser.c ./src/cdilla_interpreter.c ./src/cdilla_stack.c"
+SOURCES="$SOURCES ./src/cdilla_resolver.c ./src/cdilla_compiler.c ./src/cdilla_vm.c"
+SOURCES="$SOURCES ./src/cdilla_parallel.c ./src/cdilla_output.c ./src/cdilla_optimizer.c ./src/cdilla_cache.c ./src/cdilla_jit.c ./src/cdilla_emit_c.c ./src/cdilla_profiler.c ./src/cdilla_stats.c ./src/cdilla_trace.c"
+
+gcc $CFLAGS -o ./build/cdilla ./src/main.c $SOURCES
+
+if [ "$1" = "bench" ]
+then
+    gcc $CFLAGS -O2 -o ./build/bench_lexer ./bench/bench_lexer.c $SOURCES
+    gcc $CFLAGS -O2 -o ./build/bench_output ./bench/bench_output.c $SOURCES
+    gcc $CFLAGS -O2 -o ./build/bench_gen ./bench/bench_gen.c ./src/utils.c
+    gcc $CFLAGS -O2 -o ./build/bench_phases ./bench/bench_phases.c $SOURCES
+fi
+
+if [ "$1" = "test" ]
+then
+    gcc $CFLAGS -O2 -o ./build/lexer_diff ./tests/lexer_diff.c $SOURCES
+    gcc $CFLAGS -O2 -o ./build/leaks ./tests/leaks.c $SOURCES
+    for test in ./tests/*.sh; do
+        "$test"
+    done
+fi
 
 if [ "$1" = "run" ]
 then